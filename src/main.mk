@@ -73,6 +73,13 @@ SOURCES      := AS_global.C \
                 \
                 overlapInCore/overlapReadCache.C \
                 \
+                overlapInCore/overlapInCore-Engine.C \
+                overlapInCore/overlapInCore-Build_Hash_Index.C \
+                overlapInCore/overlapInCore-Find_Overlaps.C \
+                overlapInCore/overlapInCore-Output.C \
+                overlapInCore/overlapInCore-Process_Overlaps.C \
+                overlapInCore/overlapInCore-Process_String_Overlaps.C \
+                \
                 overlapErrorAdjustment/analyzeAlignment.C \
                 \
                 overlapInCore/liboverlap/Binomial_Bound.C \
@@ -130,6 +137,8 @@ SUBMAKEFILES := stores/gatekeeperCreate.mk \
                 stores/gatekeeperDumpMetaData.mk \
                 stores/gatekeeperPartition.mk \
                 stores/ovStoreBuild.mk \
+                stores/ovStoreCreate.mk \
+                stores/ovStoreRefilter.mk \
                 stores/ovStoreBucketizer.mk \
                 stores/ovStoreSorter.mk \
                 stores/ovStoreIndexer.mk \
@@ -189,3 +198,9 @@ SUBMAKEFILES := stores/gatekeeperCreate.mk \
                 fastq-utilities/fastqSample.mk \
                 fastq-utilities/fastqSimulate.mk \
                 fastq-utilities/fastqSimulate-sort.mk
+
+#  Tests and benchmarks are built only on request, with 'make BUILDTESTS=1'.
+
+ifeq ($(BUILDTESTS), 1)
+SUBMAKEFILES += stores/gkStoreEncodeTest.mk
+endif
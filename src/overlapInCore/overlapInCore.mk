@@ -8,12 +8,7 @@ ifeq "$(strip ${TARGET_DIR})" ""
 endif
 
 TARGET   := overlapInCore
-SOURCES  := overlapInCore.C \
-            overlapInCore-Build_Hash_Index.C \
-            overlapInCore-Find_Overlaps.C \
-            overlapInCore-Output.C \
-            overlapInCore-Process_Overlaps.C \
-            overlapInCore-Process_String_Overlaps.C
+SOURCES  := overlapInCore.C
 
 SRC_INCDIRS  := .. ../AS_UTL ../stores liboverlap
 
@@ -736,6 +736,7 @@ sub buildCorrectionLayouts ($$) {
         $cmd .= "  -S $path/$asm.globalScores.WORKING \\\n";
         $cmd .= "  -c $maxCov \\\n";
         $cmd .= "  -l $minLen \\\n";
+        $cmd .= "  -t " . getGlobal("ovsThreads") . " \\\n";
         $cmd .= "  -e " . getGlobal("corMaxEvidenceErate")  . " \\\n"  if (defined(getGlobal("corMaxEvidenceErate")));
         $cmd .= "  -legacy \\\n"                                       if (defined(getGlobal("corLegacyFilter")));
         $cmd .= "> $path/$asm.globalScores.err 2>&1";
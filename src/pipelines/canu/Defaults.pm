@@ -729,6 +729,9 @@ sub setDefaults () {
     $global{"minReadLength"}               = 1000;
     $synops{"minReadLength"}               = "Reads shorter than this length are not loaded into the assembler; default 1000";
 
+    $global{"gkpThreads"}                  = 1;
+    $synops{"gkpThreads"}                  = "Number of threads to use for encoding reads when loading them into the assembler; default 1";
+
     $global{"minOverlapLength"}            = 500;
     $synops{"minOverlapLength"}            = "Overlaps shorter than this length are not computed; default 500";
 
@@ -238,6 +238,7 @@ sub gatekeeperCreateStore ($$$@) {
     my $cmd;
     $cmd .= "$bin/gatekeeperCreate \\\n";
     $cmd .= "  -minlength " . getGlobal("minReadLength") . " \\\n";
+    $cmd .= "  -threads " . getGlobal("gkpThreads") . " \\\n";
     $cmd .= "  -o $wrk/$asm.gkpStore.BUILDING \\\n";
     $cmd .= "  $wrk/$asm.gkpStore.gkp \\\n";
     $cmd .= "> $wrk/$asm.gkpStore.BUILDING.err 2>&1";
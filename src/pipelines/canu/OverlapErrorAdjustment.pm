@@ -633,6 +633,7 @@ sub updateOverlapStore ($$) {
     $cmd .= "  -G $wrk/$asm.gkpStore \\\n";
     $cmd .= "  -O $wrk/$asm.ovlStore \\\n";
     $cmd .= "  -evalues \\\n";
+    $cmd .= "  -t " . getGlobal("ovsThreads") . " \\\n";
     $cmd .= "  -L $path/oea.files \\\n";
     $cmd .= "> $path/oea.apply.err 2>&1";
 
@@ -76,13 +76,14 @@ sub createOverlapStoreSequential ($$$$) {
 
     my $memSize = getGlobal("ovsMemory");
 
-    #  The parallel store build will unlimit 'max user processes'.  The sequential method usually
-    #  runs out of open file handles first (meaning it has never run out of processes yet).
+    #  The sequential build sorts runs of overlaps in memory and merges them into the store, needing
+    #  one open file per run; it only runs out of open file handles if memory is very small.
 
-    $cmd  = "$bin/ovStoreBuild \\\n";
+    $cmd  = "$bin/ovStoreCreate \\\n";
     $cmd .= " -O $wrk/$asm.ovlStore.BUILDING \\\n";
     $cmd .= " -G $wrk/$asm.gkpStore \\\n";
     $cmd .= " -M $memSize \\\n";
+    $cmd .= " -t " . getGlobal("ovsThreads") . " \\\n";
     $cmd .= " -L $files \\\n";
     $cmd .= " > $wrk/$asm.ovlStore.err 2>&1";
 
@@ -283,6 +284,7 @@ sub overlapStoreConfigure ($$$$) {
         print F "\$bin/ovStoreSorter \\\n";
         print F "  -deletelate \\\n";  #  Choices -deleteearly -deletelate or nothing
         print F "  -M $memLimit \\\n";
+        print F "  -t " . getGlobal("ovsThreads") . " \\\n";
         print F "  -O $wrk/$asm.ovlStore.BUILDING \\\n";
         print F "  -G $wrk/$asm.gkpStore \\\n";
         print F "  -F $numSlices \\\n";
@@ -564,6 +566,7 @@ sub generateOverlapStoreStats ($$) {
     $cmd .= " -G $wrk/$asm.gkpStore \\\n";
     $cmd .= " -O $wrk/$asm.ovlStore \\\n";
     $cmd .= " -o $wrk/$asm.ovlStore \\\n";
+    $cmd .= " -t " . getGlobal("ovsThreads") . " \\\n";
     $cmd .= " > $wrk/$asm.ovlStore.summary.err 2>&1";
 
     if (runCommand($wrk, $cmd)) {